@@ -30,6 +30,35 @@ static bool _init_env = (putenv((char*)objc_disable_warning), true);
 #include <raylib.h>
 #include <mutex>  // For thread synchronization
 #include <queue>  // For the thread-safe image queue
+#include <thread>  // For worker pool threads
+#include <condition_variable>  // For worker pool job signalling
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <filesystem>  // For creating the turntable output directory
+#include <sstream>  // For parsing command channel lines
+#include <cstdint>
+#include <atomic>
+
+// SIMD for the progressive refinement blend
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define POOMER_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define POOMER_NEON 1
+#endif
+
+// POSIX headers for the FIFO and Unix socket command channel
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(WIN32) && !defined(WIN64)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#endif
 
 //#include "bella_sdk/bella_engine.h"
 //#include "dl_core/dl_fs.h"
@@ -66,6 +95,7 @@ namespace rl {
     using ::DrawTextureEx;
     using ::LoadImage;
     using ::UnloadImage;
+    using ::ExportImage;
     using ::LoadTextureFromImage;
     using ::UnloadTexture;
     using ::GetMousePosition;
@@ -73,6 +103,7 @@ namespace rl {
     using ::IsMouseButtonPressed;
     using ::IsMouseButtonReleased;
     using ::ShowCursor;
+    using ::TextFormat;
 }
 
 // Define a callback type for receiving image data from the path tracer
@@ -92,6 +123,999 @@ struct ImageData {
     
     ImageData(unsigned char* d, int w, int h, int c) 
         : data(d), width(w), height(h), channels(c) {}
+    
+    size_t size() const {
+        return size_t(width) * height * channels;
+    }
+};
+
+// Simple fixed-size pool of worker threads
+// Jobs are run in FIFO order on whichever worker is free first.
+// wait() blocks the calling thread until every submitted job has finished.
+class WorkerPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> jobs;
+    // THREAD SAFETY: jobsMutex protects jobs, busy and stopping
+    std::mutex jobsMutex;
+    std::condition_variable jobsReady;  // Signalled when a job is queued or the pool stops
+    std::condition_variable jobsDone;   // Signalled when a worker finishes its job
+    int busy = 0;
+    bool stopping = false;
+
+    void workerLoop() {
+        for (;;) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(jobsMutex);
+                jobsReady.wait(lock, [this] { return stopping || !jobs.empty(); });
+                if (jobs.empty()) return;  // Only exit once the queue is drained
+                job = std::move(jobs.front());
+                jobs.pop();
+                busy++;
+            }
+            
+            try {
+                job();
+            } catch (const std::exception& e) {
+                std::cerr << "Exception in worker job: " << e.what() << std::endl;
+            } catch (...) {
+                std::cerr << "Unknown exception in worker job" << std::endl;
+            }
+            
+            {
+                std::lock_guard<std::mutex> lock(jobsMutex);
+                busy--;
+            }
+            jobsDone.notify_all();
+        }
+    }
+
+public:
+    explicit WorkerPool(int count) {
+        if (count < 1) count = 1;
+        for (int i = 0; i < count; i++) {
+            workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+    
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            stopping = true;
+        }
+        jobsReady.notify_all();
+        for (auto& worker : workers) worker.join();
+    }
+    
+    int size() const {
+        return static_cast<int>(workers.size());
+    }
+    
+    // THREAD SAFETY: Can be called from any thread
+    void submit(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            jobs.push(std::move(job));
+        }
+        jobsReady.notify_one();
+    }
+    
+    // Block until the queue is empty and no worker is running a job
+    void wait() {
+        std::unique_lock<std::mutex> lock(jobsMutex);
+        jobsDone.wait(lock, [this] { return jobs.empty() && busy == 0; });
+    }
+    
+    // Split [0, count) into chunks, run body(begin, end) on the workers and wait for all of them
+    // Not to be mixed with other jobs on the same pool, since wait() covers every job
+    void parallelFor(int count, const std::function<void(int, int)>& body) {
+        int chunks = std::min(count, size() * 4);
+        if (chunks <= 1) {
+            if (count > 0) body(0, count);
+            return;
+        }
+        for (int i = 0; i < chunks; i++) {
+            int begin = int(int64_t(count) * i / chunks);
+            int end = int(int64_t(count) * (i + 1) / chunks);
+            submit([&body, begin, end] { body(begin, end); });
+        }
+        wait();
+    }
+};
+
+// What to do when a frame doesn't fit in the FrameBudget
+enum class BudgetPolicy {
+    DropOldest,      // Discard queued frames, oldest first, to make room for the new one
+    SkipConversion,  // Drop the incoming frame so it is never converted or uploaded
+    Downscale        // Keep the incoming frame at a reduced resolution that fits
+};
+
+// Global byte budget for in-flight frame memory
+// Every frame buffer reserves its bytes before allocating and releases them after freeing,
+// so the total never goes over the limit. Reservation is a lock-free compare-and-swap,
+// which means the bella engine thread never blocks waiting for memory.
+class FrameBudget {
+public:
+    enum Category {
+        Queued,      // Frames waiting in the preview queue
+        Conversion,  // Frame being converted and uploaded in updateImage, moved over from Queued
+        Texture,     // Texture staging and the resident texture
+        Accumulation,  // Tile buffers of the ProgressiveBlender
+        CategoryCount
+    };
+
+private:
+    size_t limitBytes;  // 0 = unlimited, usage is still tracked for the gauges
+    BudgetPolicy budgetPolicy;
+    std::atomic<size_t> usedBytes{0};
+    std::atomic<size_t> peakBytes{0};
+    std::atomic<size_t> categoryBytes[CategoryCount] = {};
+    std::atomic<int> droppedFrames{0};
+    std::atomic<int> downscaledFrames{0};
+    std::atomic<bool> tooSmallWarned{false};
+
+public:
+    FrameBudget(size_t limit = 0, BudgetPolicy policy = BudgetPolicy::DropOldest)
+        : limitBytes(limit), budgetPolicy(policy) {}
+    
+    // Must be called before any frames arrive
+    void configure(size_t limit, BudgetPolicy policy) {
+        limitBytes = limit;
+        budgetPolicy = policy;
+    }
+    
+    // THREAD SAFETY: Can be called from any thread, never blocks
+    bool tryReserve(Category category, size_t bytes) {
+        size_t used = usedBytes.load();
+        do {
+            if (limitBytes != 0 && used + bytes > limitBytes) return false;
+        } while (!usedBytes.compare_exchange_weak(used, used + bytes));
+        
+        categoryBytes[category] += bytes;
+        size_t peak = peakBytes.load();
+        while (used + bytes > peak && !peakBytes.compare_exchange_weak(peak, used + bytes)) {}
+        return true;
+    }
+    
+    void release(Category category, size_t bytes) {
+        categoryBytes[category] -= bytes;
+        usedBytes -= bytes;
+    }
+    
+    // Move bytes already reserved from one category to another, the total is unchanged
+    void transfer(Category from, Category to, size_t bytes) {
+        categoryBytes[from] -= bytes;
+        categoryBytes[to] += bytes;
+    }
+    
+    // Warn once when the limit can't hold even one width x height frame,
+    // its queued RGBA copy plus the texture it is uploaded to
+    void warnIfTooSmall(int width, int height) {
+        size_t frameBytes = size_t(width) * height * 4 * 2;
+        if (limitBytes == 0 || frameBytes <= limitBytes || tooSmallWarned.exchange(true)) return;
+        dl::logWarning("Frame memory budget %.1f MB can't hold a %d x %d frame (%.1f MB), frames will be dropped",
+                       limitBytes / 1048576.0, width, height, frameBytes / 1048576.0);
+    }
+    
+    void countDropped() { droppedFrames++; }
+    void countDownscaled() { downscaledFrames++; }
+    
+    bool limited() const { return limitBytes != 0; }
+    size_t limit() const { return limitBytes; }
+    BudgetPolicy policy() const { return budgetPolicy; }
+    size_t used() const { return usedBytes.load(); }
+    size_t peak() const { return peakBytes.load(); }
+    size_t used(Category category) const { return categoryBytes[category].load(); }
+    int dropped() const { return droppedFrames.load(); }
+    int downscaled() const { return downscaledFrames.load(); }
+    
+    static bool parsePolicy(const char* name, BudgetPolicy& policy) {
+        std::string value = name;
+        if (value == "dropoldest") policy = BudgetPolicy::DropOldest;
+        else if (value == "skip") policy = BudgetPolicy::SkipConversion;
+        else if (value == "downscale") policy = BudgetPolicy::Downscale;
+        else return false;
+        return true;
+    }
+};
+
+// Shrink an image by an integer factor, keeping every factor'th pixel of every factor'th row
+// A plain copy per pixel, cheap enough to run on the bella engine thread.
+// dst must hold (width/factor)*(height/factor)*channels bytes and may be src itself,
+// since each pixel is read at or after the position it is written to.
+static void downscaleImage(const unsigned char* src, int width, int height, int channels,
+                           int factor, unsigned char* dst) {
+    int dstWidth = std::max(1, width / factor);
+    int dstHeight = std::max(1, height / factor);
+    for (int y = 0; y < dstHeight; y++) {
+        const unsigned char* row = src + size_t(y) * factor * width * channels;
+        for (int x = 0; x < dstWidth; x++) {
+            std::memmove(dst, row + size_t(x) * factor * channels, channels);
+            dst += channels;
+        }
+    }
+}
+
+// Four-channel pixel helpers for the progressive blend
+// One RGBA pixel maps onto one 128-bit vector, with SSE2 on x86_64, NEON on arm64
+// and a scalar fallback elsewhere
+#if defined(POOMER_SSE2)
+using Pixel4 = __m128;
+
+static inline Pixel4 loadRgba8(const unsigned char* p) {
+    int32_t packed;
+    std::memcpy(&packed, p, 4);
+    __m128i zero = _mm_setzero_si128();
+    __m128i wide = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+    return _mm_mul_ps(_mm_cvtepi32_ps(wide), _mm_set1_ps(1.0f / 255.0f));
+}
+static inline void storeRgba8(unsigned char* p, Pixel4 v) {
+    __m128i wide = _mm_cvtps_epi32(_mm_mul_ps(v, _mm_set1_ps(255.0f)));
+    __m128i words = _mm_packs_epi32(wide, wide);
+    __m128i narrow = _mm_packus_epi16(words, words);
+    int32_t packed = _mm_cvtsi128_si32(narrow);
+    std::memcpy(p, &packed, 4);
+}
+static inline Pixel4 loadPixel(const float* p) { return _mm_loadu_ps(p); }
+static inline void storePixel(float* p, Pixel4 v) { _mm_storeu_ps(p, v); }
+static inline Pixel4 zeroPixel() { return _mm_setzero_ps(); }
+static inline Pixel4 addPixel(Pixel4 a, Pixel4 b) { return _mm_add_ps(a, b); }
+static inline Pixel4 absDiffPixel(Pixel4 a, Pixel4 b) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(a, b));
+}
+static inline Pixel4 lerpPixel(Pixel4 a, Pixel4 b, float t) {
+    return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_set1_ps(t)));
+}
+static inline float sumRgb(Pixel4 v) {
+    alignas(16) float f[4];
+    _mm_store_ps(f, v);
+    return f[0] + f[1] + f[2];
+}
+#elif defined(POOMER_NEON)
+using Pixel4 = float32x4_t;
+
+static inline Pixel4 loadRgba8(const unsigned char* p) {
+    uint32_t packed;
+    std::memcpy(&packed, p, 4);
+    uint16x8_t wide = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)));
+    return vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide))), 1.0f / 255.0f);
+}
+static inline void storeRgba8(unsigned char* p, Pixel4 v) {
+    uint32x4_t wide = vcvtq_u32_f32(vaddq_f32(vmulq_n_f32(v, 255.0f), vdupq_n_f32(0.5f)));
+    uint16x4_t half = vmovn_u32(wide);
+    uint8x8_t narrow = vmovn_u16(vcombine_u16(half, half));
+    uint32_t packed = vget_lane_u32(vreinterpret_u32_u8(narrow), 0);
+    std::memcpy(p, &packed, 4);
+}
+static inline Pixel4 loadPixel(const float* p) { return vld1q_f32(p); }
+static inline void storePixel(float* p, Pixel4 v) { vst1q_f32(p, v); }
+static inline Pixel4 zeroPixel() { return vdupq_n_f32(0.0f); }
+static inline Pixel4 addPixel(Pixel4 a, Pixel4 b) { return vaddq_f32(a, b); }
+static inline Pixel4 absDiffPixel(Pixel4 a, Pixel4 b) { return vabdq_f32(a, b); }
+static inline Pixel4 lerpPixel(Pixel4 a, Pixel4 b, float t) { return vmlaq_n_f32(a, vsubq_f32(b, a), t); }
+static inline float sumRgb(Pixel4 v) {
+    return vgetq_lane_f32(v, 0) + vgetq_lane_f32(v, 1) + vgetq_lane_f32(v, 2);
+}
+#else
+struct Pixel4 { float c[4]; };
+
+static inline Pixel4 loadRgba8(const unsigned char* p) {
+    return {{p[0] / 255.0f, p[1] / 255.0f, p[2] / 255.0f, p[3] / 255.0f}};
+}
+static inline void storeRgba8(unsigned char* p, Pixel4 v) {
+    for (int i = 0; i < 4; i++) p[i] = (unsigned char)(std::min(std::max(v.c[i], 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+static inline Pixel4 loadPixel(const float* p) { return {{p[0], p[1], p[2], p[3]}}; }
+static inline void storePixel(float* p, Pixel4 v) { std::memcpy(p, v.c, sizeof(v.c)); }
+static inline Pixel4 zeroPixel() { return {{0.0f, 0.0f, 0.0f, 0.0f}}; }
+static inline Pixel4 addPixel(Pixel4 a, Pixel4 b) {
+    return {{a.c[0] + b.c[0], a.c[1] + b.c[1], a.c[2] + b.c[2], a.c[3] + b.c[3]}};
+}
+static inline Pixel4 absDiffPixel(Pixel4 a, Pixel4 b) {
+    return {{std::fabs(a.c[0] - b.c[0]), std::fabs(a.c[1] - b.c[1]), std::fabs(a.c[2] - b.c[2]), std::fabs(a.c[3] - b.c[3])}};
+}
+static inline Pixel4 lerpPixel(Pixel4 a, Pixel4 b, float t) {
+    return {{a.c[0] + (b.c[0] - a.c[0]) * t, a.c[1] + (b.c[1] - a.c[1]) * t,
+             a.c[2] + (b.c[2] - a.c[2]) * t, a.c[3] + (b.c[3] - a.c[3]) * t}};
+}
+static inline float sumRgb(Pixel4 v) { return v.c[0] + v.c[1] + v.c[2]; }
+#endif
+
+// Progressive refinement display
+// After a scene edit restarts the render, the first frames are noisy. Instead of replacing
+// the last good image with them, each tile shows a blend of the last converged frame (the
+// reference) and the incoming frame, weighted by an estimate of each tile's sample count.
+// The estimate comes from how much a tile changes between successive frames: path traced
+// noise falls off with the square root of the sample count, so 1/change^2 tracks samples.
+// Once a tile's new render outweighs the reference it switches to the new frame for good.
+//
+// Frames are kept as float RGBA in tiles of TileSize x TileSize pixels, each tile contiguous,
+// so a tile stays in cache for both the change estimate and the blend. The tile grid keeps the
+// resolution of the largest frame seen: smaller frames with the same aspect ratio (low resolution
+// interactive frames, or the downscale memory policy) are resampled onto it, and a larger frame
+// resamples the grid up. Camera changes call snap(), since the reference can't be reprojected
+// to the new view; so does a change of aspect ratio.
+class ProgressiveBlender {
+public:
+    static constexpr int TileSize = 32;
+    static constexpr int TilePixels = TileSize * TileSize;
+
+private:
+    int width = 0;
+    int height = 0;
+    int tilesX = 0;
+    int tilesY = 0;
+    
+    // Tiled float RGBA, TilePixels * 4 floats per tile
+    std::vector<float> reference;  // Last converged image being refined away from
+    std::vector<float> previous;   // Last incoming frame, resampled onto the grid
+    std::vector<unsigned char> display;  // Grid sized RGBA8 output for frames smaller than the grid
+    
+    std::vector<float> referenceWeight;  // Estimated sample weight per reference tile
+    std::vector<float> tileWeight;       // Estimated sample weight per tile of the last incoming frame
+    std::vector<float> tileAlpha;        // Blend factor used for each tile on the last frame
+    std::vector<unsigned char> overtaken;  // Tiles where the new render has taken over
+    
+    bool blending = false;       // Blending towards the new render, otherwise frames pass through
+    bool previousValid = false;  // previous holds a frame from the current render
+    int framesSinceRestart = 0;
+    int referenceFrames = 0;     // Frames the reference render had accumulated
+    
+    WorkerPool workers;
+    FrameBudget* budget = nullptr;
+    size_t reservedBytes = 0;
+    bool budgetWarned = false;
+    
+    int tileCount() const {
+        return tilesX * tilesY;
+    }
+    
+    // Free the tile buffers and hand their bytes back to the budget
+    // Swapping with empty vectors is what actually returns the memory, clear() keeps the capacity
+    void freeBuffers() {
+        std::vector<float>().swap(reference);
+        std::vector<float>().swap(previous);
+        std::vector<float>().swap(referenceWeight);
+        std::vector<float>().swap(tileWeight);
+        std::vector<float>().swap(tileAlpha);
+        std::vector<unsigned char>().swap(overtaken);
+        std::vector<unsigned char>().swap(display);
+        if (budget) budget->release(FrameBudget::Accumulation, reservedBytes);
+        reservedBytes = 0;
+        width = height = tilesX = tilesY = 0;
+    }
+    
+    // (Re)allocate the tile buffers for a new frame size, returns false if they don't fit the budget
+    // The old buffers are freed first so the old and new sizes are never held at once
+    bool allocate(int w, int h) {
+        freeBuffers();
+        
+        size_t bytes = bytesFor(w, h);
+        if (budget && !budget->tryReserve(FrameBudget::Accumulation, bytes)) {
+            if (!budgetWarned) {
+                dl::logWarning("Progressive refinement disabled, its %.1f MB for %d x %d frames doesn't fit the frame memory budget",
+                               bytes / 1048576.0, w, h);
+                budgetWarned = true;
+            }
+            return false;
+        }
+        reservedBytes = bytes;
+        
+        // Constructed at exactly the reserved size
+        width = w;
+        height = h;
+        tilesX = (w + TileSize - 1) / TileSize;
+        tilesY = (h + TileSize - 1) / TileSize;
+        size_t tiles = size_t(tileCount());
+        reference = std::vector<float>(tiles * TilePixels * 4, 0.0f);
+        previous = std::vector<float>(tiles * TilePixels * 4, 0.0f);
+        display = std::vector<unsigned char>(size_t(w) * h * 4);
+        referenceWeight = std::vector<float>(tiles, 0.0f);
+        tileWeight = std::vector<float>(tiles, 0.0f);
+        tileAlpha = std::vector<float>(tiles, 1.0f);
+        overtaken = std::vector<unsigned char>(tiles, 1);
+        return true;
+    }
+    
+    // Bytes of every buffer for a w x h grid
+    static size_t bytesFor(int w, int h) {
+        size_t tiles = size_t((w + TileSize - 1) / TileSize) * ((h + TileSize - 1) / TileSize);
+        return tiles * TilePixels * 4 * sizeof(float) * 2 + size_t(w) * h * 4 + tiles * (sizeof(float) * 3 + 1);
+    }
+    
+    // Same aspect ratio as the grid, allowing for the rounding of integer downscales
+    bool sameAspect(int w, int h) const {
+        long long skew = (long long)w * height - (long long)h * width;
+        if (skew < 0) skew = -skew;
+        return skew <= (long long)w + h + width + height;
+    }
+    
+    // A frame that can be resampled onto the current grid
+    bool fitsGrid(int w, int h) const {
+        return tileCount() != 0 && w <= width && h <= height && sameAspect(w, h);
+    }
+    
+    // Offset of grid pixel (x, y) in a tiled float buffer
+    size_t tiledOffset(int x, int y) const {
+        size_t tile = size_t(y / TileSize) * tilesX + x / TileSize;
+        return (tile * TilePixels + (y % TileSize) * TileSize + x % TileSize) * 4;
+    }
+    
+    // Resample the grid up to a larger w x h frame, keeping the reference and its weights
+    // Both grids are held while copying, so both are reserved; returns false if that doesn't fit
+    bool regrid(int w, int h) {
+        size_t bytes = bytesFor(w, h);
+        if (budget && !budget->tryReserve(FrameBudget::Accumulation, bytes)) return false;
+        
+        int tx = (w + TileSize - 1) / TileSize;
+        int ty = (h + TileSize - 1) / TileSize;
+        size_t tiles = size_t(tx) * ty;
+        std::vector<float> newReference(tiles * TilePixels * 4, 0.0f);
+        std::vector<float> newPrevious(tiles * TilePixels * 4, 0.0f);
+        std::vector<float> newReferenceWeight(tiles), newTileWeight(tiles), newTileAlpha(tiles);
+        std::vector<unsigned char> newOvertaken(tiles);
+        
+        workers.parallelFor(int(tiles), [&](int begin, int end) {
+            for (int t = begin; t < end; t++) {
+                int x0 = (t % tx) * TileSize;
+                int y0 = (t / tx) * TileSize;
+                int tw = std::min(TileSize, w - x0);
+                int th = std::min(TileSize, h - y0);
+                for (int y = 0; y < th; y++) {
+                    int oy = int(int64_t(y0 + y) * height / h);
+                    for (int x = 0; x < tw; x++) {
+                        int ox = int(int64_t(x0 + x) * width / w);
+                        size_t dst = (size_t(t) * TilePixels + y * TileSize + x) * 4;
+                        size_t src = tiledOffset(ox, oy);
+                        storePixel(&newReference[dst], loadPixel(&reference[src]));
+                        storePixel(&newPrevious[dst], loadPixel(&previous[src]));
+                    }
+                }
+                
+                // Per tile state comes from the old tile under this tile's centre
+                int cx = int(int64_t(x0 + tw / 2) * width / w);
+                int cy = int(int64_t(y0 + th / 2) * height / h);
+                int old = (cy / TileSize) * tilesX + cx / TileSize;
+                newReferenceWeight[t] = referenceWeight[old];
+                newTileWeight[t] = tileWeight[old];
+                newTileAlpha[t] = tileAlpha[old];
+                newOvertaken[t] = overtaken[old];
+            }
+        });
+        
+        freeBuffers();
+        reservedBytes = bytes;
+        width = w;
+        height = h;
+        tilesX = tx;
+        tilesY = ty;
+        reference = std::move(newReference);
+        previous = std::move(newPrevious);
+        display = std::vector<unsigned char>(size_t(w) * h * 4);
+        referenceWeight = std::move(newReferenceWeight);
+        tileWeight = std::move(newTileWeight);
+        tileAlpha = std::move(newTileAlpha);
+        overtaken = std::move(newOvertaken);
+        
+        // previous is an upsampled frame now, so the next change estimate would be meaningless
+        previousValid = false;
+        return true;
+    }
+    
+    // Measure, blend and store tiles [begin, end) of an incoming srcWidth x srcHeight frame
+    // A frame smaller than the grid is sampled nearest onto it. Blended tiles are written to out,
+    // which is the frame itself at grid size, display for a smaller frame, or null when passing
+    // through a smaller frame. Returns the number of tiles the new render has overtaken
+    int processTiles(const unsigned char* rgba, int srcWidth, int srcHeight, unsigned char* out, int begin, int end) {
+        bool resampled = srcWidth != width || srcHeight != height;
+        alignas(16) float incoming[TilePixels * 4];
+        int overtakenCount = 0;
+        
+        for (int t = begin; t < end; t++) {
+            int x0 = (t % tilesX) * TileSize;
+            int y0 = (t / tilesX) * TileSize;
+            int tw = std::min(TileSize, width - x0);
+            int th = std::min(TileSize, height - y0);
+            float* prev = previous.data() + size_t(t) * TilePixels * 4;
+            float* ref = reference.data() + size_t(t) * TilePixels * 4;
+            
+            // Convert to float and measure the change since the previous frame of this render
+            Pixel4 change = zeroPixel();
+            for (int y = 0; y < th; y++) {
+                int sy = resampled ? int(int64_t(y0 + y) * srcHeight / height) : y0 + y;
+                const unsigned char* src = rgba + size_t(sy) * srcWidth * 4;
+                float* dst = incoming + y * TileSize * 4;
+                const float* old = prev + y * TileSize * 4;
+                for (int x = 0; x < tw; x++) {
+                    int sx = resampled ? int(int64_t(x0 + x) * srcWidth / width) : x0 + x;
+                    Pixel4 p = loadRgba8(src + sx * 4);
+                    storePixel(dst + x * 4, p);
+                    change = addPixel(change, absDiffPixel(p, loadPixel(old + x * 4)));
+                }
+            }
+            
+            // Sample weight estimate, nothing is known about the first frame after a restart
+            float meanChange = sumRgb(change) / float(tw * th * 3);
+            float weight = previousValid ? 1.0f / (meanChange * meanChange + 1e-8f) : 0.0f;
+            tileWeight[t] = weight;
+            
+            float alpha = 1.0f;
+            if (blending && !overtaken[t]) {
+                if (framesSinceRestart >= referenceFrames || (previousValid && weight >= referenceWeight[t])) {
+                    overtaken[t] = 1;
+                } else if (weight + referenceWeight[t] <= 0.0f) {
+                    // Neither render has a weight estimate yet (edit right after a snap),
+                    // keep showing the reference rather than dividing by zero
+                    alpha = 0.0f;
+                } else {
+                    alpha = weight / (weight + referenceWeight[t]);
+                }
+            }
+            tileAlpha[t] = alpha;
+            if (overtaken[t]) overtakenCount++;
+            
+            if (out && alpha < 1.0f) {
+                for (int y = 0; y < th; y++) {
+                    unsigned char* row = out + (size_t(y0 + y) * width + x0) * 4;
+                    const float* a = ref + y * TileSize * 4;
+                    const float* b = incoming + y * TileSize * 4;
+                    for (int x = 0; x < tw; x++) {
+                        storeRgba8(row + x * 4, lerpPixel(loadPixel(a + x * 4), loadPixel(b + x * 4), alpha));
+                    }
+                }
+            } else if (out && resampled) {
+                // Nothing to blend, but display still needs the resampled frame
+                for (int y = 0; y < th; y++) {
+                    unsigned char* row = out + (size_t(y0 + y) * width + x0) * 4;
+                    const float* b = incoming + y * TileSize * 4;
+                    for (int x = 0; x < tw; x++) {
+                        storeRgba8(row + x * 4, loadPixel(b + x * 4));
+                    }
+                }
+            }
+            
+            std::memcpy(prev, incoming, sizeof(incoming));
+        }
+        return overtakenCount;
+    }
+
+public:
+    ProgressiveBlender()
+        : workers((int)std::max(1u, std::thread::hardware_concurrency() / 2)) {}
+    
+    ~ProgressiveBlender() {
+        freeBuffers();
+    }
+    
+    void setBudget(FrameBudget* frameBudget) {
+        budget = frameBudget;
+    }
+    
+    // The view changed, show incoming frames as they are
+    void snap() {
+        blending = false;
+        previousValid = false;
+        framesSinceRestart = 0;
+    }
+    
+    // The scene changed without moving the view, so the image on screen becomes the
+    // reference that the new render is blended in over
+    void beginRefinement() {
+        if (!previousValid || tileCount() == 0) {
+            snap();
+            return;
+        }
+        
+        workers.parallelFor(tileCount(), [this](int begin, int end) {
+            for (int t = begin; t < end; t++) {
+                float* ref = reference.data() + size_t(t) * TilePixels * 4;
+                const float* prev = previous.data() + size_t(t) * TilePixels * 4;
+                float alpha = blending ? tileAlpha[t] : 1.0f;
+                if (alpha >= 1.0f) {
+                    std::memcpy(ref, prev, TilePixels * 4 * sizeof(float));
+                    referenceWeight[t] = tileWeight[t];
+                } else {
+                    // Still mid-blend, keep what is on screen
+                    for (int i = 0; i < TilePixels * 4; i += 4) {
+                        storePixel(ref + i, lerpPixel(loadPixel(ref + i), loadPixel(prev + i), alpha));
+                    }
+                    referenceWeight[t] = std::max(referenceWeight[t], tileWeight[t]);
+                }
+                overtaken[t] = 0;
+            }
+        });
+        
+        referenceFrames = blending ? std::max(referenceFrames, framesSinceRestart) : framesSinceRestart;
+        blending = true;
+        previousValid = false;
+        framesSinceRestart = 0;
+    }
+    
+    // Size process() will return for a w x h frame, so the caller can budget its texture first
+    void displaySize(int w, int h, int& outWidth, int& outHeight) const {
+        bool toGrid = blending && fitsGrid(w, h);
+        outWidth = toGrid ? width : w;
+        outHeight = toGrid ? height : h;
+    }
+    
+    // Blend an incoming RGBA8 frame, call from the main thread
+    // Frames at grid size are blended in place. A smaller frame is blended onto the grid and
+    // the grid sized display buffer is returned, or passed through while not blending.
+    // w and h are updated to the size of the returned image
+    const unsigned char* process(unsigned char* rgba, int& w, int& h) {
+        if (!fitsGrid(w, h)) {
+            // A larger frame of the same view resamples the grid up, keeping the reference.
+            // Anything else is a new view (or the regrid doesn't fit), so start over at this size
+            bool regridded = tileCount() != 0 && sameAspect(w, h) && regrid(w, h);
+            if (!regridded) {
+                snap();
+                if (!allocate(w, h)) return rgba;
+            }
+        }
+        
+        bool resampled = w != width || h != height;
+        unsigned char* out = !resampled ? rgba : (blending ? display.data() : nullptr);
+        
+        std::atomic<int> overtakenTotal{0};
+        workers.parallelFor(tileCount(), [this, rgba, w, h, out, &overtakenTotal](int begin, int end) {
+            overtakenTotal += processTiles(rgba, w, h, out, begin, end);
+        });
+        
+        framesSinceRestart++;
+        previousValid = true;
+        if (blending && overtakenTotal == tileCount()) {
+            blending = false;
+        }
+        
+        if (out && out != rgba) {
+            w = width;
+            h = height;
+            return out;
+        }
+        return rgba;
+    }
+};
+
+// A single parsed scene edit from the command channel
+// Line protocol, one edit per line, '#' starts a comment:
+//   real   <node>.<attr> <value>
+//   int    <node>.<attr> <value>
+//   bool   <node>.<attr> <0|1|true|false>
+//   string <node>.<attr> <rest of line, '#' included>
+//   rgba   <node>.<attr> <r> <g> <b> [a]
+//   vec3   <node>.<attr> <x> <y> <z>
+struct SceneEditCommand {
+    enum class Kind { Real, Int, Bool, String, Rgba, Vec3 };
+    
+    Kind kind = Kind::Real;
+    std::string node;
+    std::string attr;
+    double values[4] = {0.0, 0.0, 0.0, 1.0};
+    std::string text;
+    std::chrono::steady_clock::time_point received;
+    
+    // True when only whitespace or a '#' comment is left on the line
+    static bool atLineEnd(std::istringstream& in) {
+        in >> std::ws;
+        return in.eof() || in.peek() == '#';
+    }
+    
+    // Parse one protocol line, returns false and fills error for malformed input
+    static bool parse(const std::string& line, SceneEditCommand& cmd, std::string& error) {
+        std::istringstream in(line);
+        std::string type, target;
+        if (!(in >> type >> target)) {
+            error = "expected <type> <node>.<attr> <value>";
+            return false;
+        }
+        
+        size_t dot = target.rfind('.');
+        if (dot == std::string::npos || dot == 0 || dot + 1 == target.size()) {
+            error = "target must be <node>.<attr>";
+            return false;
+        }
+        cmd.node = target.substr(0, dot);
+        cmd.attr = target.substr(dot + 1);
+        
+        int count = 0;
+        if (type == "real") {
+            cmd.kind = Kind::Real;
+            count = 1;
+        } else if (type == "int") {
+            cmd.kind = Kind::Int;
+            // Integer extraction, so a fraction or exponent is left over and rejected
+            long long value = 0;
+            if (!(in >> value) || in.peek() == '.' || in.peek() == 'e' || in.peek() == 'E') {
+                error = "int expects a whole number";
+                return false;
+            }
+            if (value < INT32_MIN || value > INT32_MAX) {
+                error = "int value out of range";
+                return false;
+            }
+            cmd.values[0] = double(value);
+        } else if (type == "vec3") {
+            cmd.kind = Kind::Vec3;
+            count = 3;
+        } else if (type == "rgba") {
+            cmd.kind = Kind::Rgba;
+            count = 3;  // Alpha is optional
+        } else if (type == "bool") {
+            cmd.kind = Kind::Bool;
+            std::string value;
+            in >> value;
+            if (value == "1" || value == "true") cmd.values[0] = 1.0;
+            else if (value == "0" || value == "false") cmd.values[0] = 0.0;
+            else {
+                error = "bool expects 0, 1, true or false";
+                return false;
+            }
+        } else if (type == "string") {
+            cmd.kind = Kind::String;
+            std::getline(in >> std::ws, cmd.text);
+            return true;
+        } else {
+            error = "unknown type " + type;
+            return false;
+        }
+        
+        for (int i = 0; i < count; i++) {
+            if (!(in >> cmd.values[i])) {
+                error = type + " expects " + std::to_string(count) + " number(s)";
+                return false;
+            }
+        }
+        if (cmd.kind == Kind::Rgba && !atLineEnd(in) && !(in >> cmd.values[3])) {
+            error = "rgba alpha must be a number";
+            return false;
+        }
+        
+        if (!atLineEnd(in)) {
+            error = "unexpected text after the value";
+            return false;
+        }
+        return true;
+    }
+};
+
+// Command channel for pushing scene edits into a running session
+// Reads the line protocol of SceneEditCommand from stdin, a FIFO or a Unix socket.
+// Lines are read and parsed on a background thread; the main thread drains whatever
+// arrived since the last tick and applies it in one EventScope.
+class SceneCommandChannel {
+private:
+    // State shared with the reader thread
+    // Held by shared_ptr so a reader that outlives the channel (detached on Windows)
+    // still has somewhere valid to put lines
+    struct Inbox {
+        std::atomic<bool> stopping{false};
+        // THREAD SAFETY: mutex protects pending, filled by the reader thread
+        // and drained by the main thread
+        std::mutex mutex;
+        std::vector<SceneEditCommand> pending;
+    };
+    
+    std::string source;
+    std::thread reader;
+    std::shared_ptr<Inbox> inbox = std::make_shared<Inbox>();
+    
+    static void handleLine(Inbox& box, const std::string& line) {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') return;
+        
+        SceneEditCommand cmd;
+        std::string error;
+        if (!SceneEditCommand::parse(line.substr(start), cmd, error)) {
+            dl::logError("Command channel: %s in '%s'", error.c_str(), line.c_str());
+            return;
+        }
+        cmd.received = std::chrono::steady_clock::now();
+        
+        std::lock_guard<std::mutex> lock(box.mutex);
+        if (!box.stopping) box.pending.push_back(std::move(cmd));
+    }
+
+#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+    // Only stdin is supported on Windows; std::getline can't be interrupted
+    // so the reader thread is detached rather than joined on shutdown.
+    // It only touches the Inbox it co-owns, never the channel itself.
+    static void readLoop(std::shared_ptr<Inbox> box) {
+        std::string line;
+        while (!box->stopping && std::getline(std::cin, line)) {
+            handleLine(*box, line);
+        }
+    }
+    
+    void startReader() {
+        reader = std::thread(readLoop, inbox);
+    }
+    
+    bool open() {
+        if (source != "stdin" && source != "-") {
+            dl::logError("Command channel: only stdin is supported on Windows");
+            return false;
+        }
+        return true;
+    }
+    
+    void close() {
+        if (reader.joinable()) reader.detach();
+    }
+#else
+    // Each readable file descriptor keeps its own partial line
+    struct Connection {
+        int fd;
+        std::string partial;
+    };
+    std::vector<Connection> connections;
+    int listenFd = -1;
+    
+    // Remove a stale socket left at path by an earlier run
+    // Returns false without touching it when something other than a socket lives there
+    static bool removeSocketFile(const std::string& path) {
+        struct stat info;
+        if (::lstat(path.c_str(), &info) != 0) return errno == ENOENT;
+        if (!S_ISSOCK(info.st_mode)) return false;
+        return ::unlink(path.c_str()) == 0;
+    }
+    
+    // Longest line accepted, a client that goes past it without a newline is dropped
+    static const size_t MaxLineLength = 64 * 1024;
+    
+    // Read what is available on a connection, returns false on EOF, error or an overlong line
+    bool readConnection(Connection& conn) {
+        char buffer[4096];
+        ssize_t n;
+        do {
+            n = ::read(conn.fd, buffer, sizeof(buffer));
+        } while (n < 0 && errno == EINTR);
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+        if (n <= 0) return false;
+        
+        conn.partial.append(buffer, n);
+        size_t newline;
+        while ((newline = conn.partial.find('\n')) != std::string::npos) {
+            handleLine(*inbox, conn.partial.substr(0, newline));
+            conn.partial.erase(0, newline + 1);
+        }
+        
+        if (conn.partial.size() > MaxLineLength) {
+            dl::logError("Command channel: line longer than %d bytes, closing connection", (int)MaxLineLength);
+            return false;
+        }
+        return true;
+    }
+    
+    void readLoop() {
+        std::vector<pollfd> fds;
+        while (!inbox->stopping) {
+            fds.clear();
+            if (listenFd >= 0) fds.push_back({listenFd, POLLIN, 0});
+            for (auto& conn : connections) fds.push_back({conn.fd, POLLIN, 0});
+            
+            // Wake up periodically so close() can stop the thread
+            int ready = ::poll(fds.data(), fds.size(), 100);
+            if (ready <= 0) continue;
+            
+            size_t index = 0;
+            if (listenFd >= 0) {
+                if (fds[index].revents & POLLIN) {
+                    int client = ::accept(listenFd, nullptr, nullptr);
+                    if (client >= 0) connections.push_back({client, ""});
+                }
+                index++;
+            }
+            
+            for (size_t i = 0; i < connections.size() && index < fds.size(); index++) {
+                if (fds[index].revents & (POLLIN | POLLHUP | POLLERR)) {
+                    if (!readConnection(connections[i])) {
+                        if (connections[i].fd != STDIN_FILENO) ::close(connections[i].fd);
+                        connections.erase(connections.begin() + i);
+                        continue;
+                    }
+                }
+                i++;
+            }
+        }
+    }
+    
+    bool open() {
+        if (source == "stdin" || source == "-") {
+            connections.push_back({STDIN_FILENO, ""});
+            return true;
+        }
+        
+        if (source.rfind("fifo:", 0) == 0) {
+            std::string path = source.substr(5);
+            if (::mkfifo(path.c_str(), 0600) != 0 && errno != EEXIST) {
+                dl::logError("Command channel: cannot create fifo %s", path.c_str());
+                return false;
+            }
+            // Opened read-write so the fifo never reports EOF when a writer disconnects
+            int fd = ::open(path.c_str(), O_RDWR | O_NONBLOCK);
+            if (fd < 0) {
+                dl::logError("Command channel: cannot open fifo %s", path.c_str());
+                return false;
+            }
+            connections.push_back({fd, ""});
+            return true;
+        }
+        
+        if (source.rfind("unix:", 0) == 0) {
+            std::string path = source.substr(5);
+            sockaddr_un addr = {};
+            addr.sun_family = AF_UNIX;
+            if (path.size() >= sizeof(addr.sun_path)) {
+                dl::logError("Command channel: socket path too long %s", path.c_str());
+                return false;
+            }
+            std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+            
+            if (!removeSocketFile(path)) {
+                dl::logError("Command channel: %s exists and is not a socket, refusing to replace it", path.c_str());
+                return false;
+            }
+            
+            listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (listenFd < 0 ||
+                ::bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+                ::listen(listenFd, 4) != 0) {
+                dl::logError("Command channel: cannot listen on %s", path.c_str());
+                if (listenFd >= 0) ::close(listenFd);
+                listenFd = -1;
+                return false;
+            }
+            return true;
+        }
+        
+        dl::logError("Command channel: unknown source %s, use stdin, fifo:<path> or unix:<path>", source.c_str());
+        return false;
+    }
+    
+    void startReader() {
+        reader = std::thread([this] { readLoop(); });
+    }
+    
+    void close() {
+        if (reader.joinable()) reader.join();
+        for (auto& conn : connections) {
+            if (conn.fd != STDIN_FILENO) ::close(conn.fd);
+        }
+        connections.clear();
+        if (listenFd >= 0) {
+            ::close(listenFd);
+            removeSocketFile(source.substr(5));
+            listenFd = -1;
+        }
+    }
+#endif
+
+public:
+    explicit SceneCommandChannel(const std::string& sourceSpec) : source(sourceSpec) {}
+    
+    ~SceneCommandChannel() {
+        stop();
+    }
+    
+    bool start() {
+        if (!open()) return false;
+        startReader();
+        dl::logInfo("Command channel listening on %s", source.c_str());
+        return true;
+    }
+    
+    void stop() {
+        inbox->stopping = true;
+        close();
+    }
+    
+    // THREAD SAFETY: Swap out everything received since the last call
+    void drain(std::vector<SceneEditCommand>& out) {
+        out.clear();
+        std::lock_guard<std::mutex> lock(inbox->mutex);
+        out.swap(inbox->pending);
+    }
 };
 
 class PathTracerPreview {
@@ -105,6 +1129,14 @@ private:
     rl::Texture2D texture;
     bool imageLoaded;
     float imageScale;
+    size_t textureBytes = 0;  // Bytes reserved in frameBudget for the current texture
+    
+    // Byte budget shared by the queued frames, conversion, texture and blend buffers
+    FrameBudget frameBudget;
+    
+    // Blends restarted renders in over the last converged image, declared after
+    // frameBudget because it releases its buffers into it on destruction
+    ProgressiveBlender blender;
     
     // THREAD SAFETY: These members handle safe communication between threads
     // The mutex protects access to the queue, ensuring only one thread can modify it at a time
@@ -125,6 +1157,10 @@ private:
     rl::Vector2 prevMousePos = {0, 0};
     dl::bella_sdk::Engine* engine = nullptr;  // Reference to the bella engine for camera control
     
+    // Scripted scene edits, drained once per tick
+    SceneCommandChannel* commandChannel = nullptr;
+    std::vector<SceneEditCommand> editBatch;  // Reused between ticks to avoid reallocating
+    
     // Store initial camera state for reset functionality
     bool hasInitialCamera = false;
     // We won't store the transform directly since the API doesn't support it
@@ -159,6 +1195,8 @@ public:
             this->queueImageData(data, width, height, channels);
         };
         
+        blender.setBudget(&frameBudget);
+        
         //std::cout << "Window initialized successfully" << std::endl;
     }
     
@@ -174,9 +1212,27 @@ public:
         */
     }
     
+    // Set the frame memory budget, call before the engine starts producing images
+    void setMemoryBudget(size_t limitBytes, BudgetPolicy policy) {
+        frameBudget.configure(limitBytes, policy);
+    }
+    
+    FrameBudget& getBudget() {
+        return frameBudget;
+    }
+    
+    // Set the command channel that scripted scene edits are read from
+    void setCommandChannel(SceneCommandChannel* channel) {
+        commandChannel = channel;
+    }
+    
     ~PathTracerPreview() {
         // Clean up resources
         if (texture.id != 0) rl::UnloadTexture(texture);
+        frameBudget.release(FrameBudget::Texture, textureBytes);
+        
+        dl::logInfo("Frame memory peak %.1f MB, %d frames dropped, %d downscaled",
+                    frameBudget.peak() / 1048576.0, frameBudget.dropped(), frameBudget.downscaled());
         
         // THREAD SAFETY: Clean up any remaining image data in the queue
         clearImageQueue();
@@ -200,18 +1256,92 @@ public:
             return;
         }
         
+        // Reserve budget for the copy before allocating it
+        // This never blocks, so when the budget is exhausted the policy decides what gives way.
+        // Frames are always queued as RGBA so updateImage can convert and upload them in place.
+        size_t dataSize = size_t(width) * height * 4;
+        int factor = 1;
+        bool reserved = frameBudget.tryReserve(FrameBudget::Queued, dataSize);
+        if (!reserved) {
+            switch (frameBudget.policy()) {
+                case BudgetPolicy::DropOldest:
+                    reserved = dropQueuedFramesFor(dataSize);
+                    break;
+                case BudgetPolicy::SkipConversion:
+                    break;
+                case BudgetPolicy::Downscale:
+                    // Halve the resolution until the copy fits
+                    while (!reserved && (width / factor > 1 || height / factor > 1)) {
+                        factor *= 2;
+                        dataSize = size_t(std::max(1, width / factor)) * std::max(1, height / factor) * 4;
+                        reserved = frameBudget.tryReserve(FrameBudget::Queued, dataSize);
+                    }
+                    break;
+            }
+        }
+        if (!reserved) {
+            frameBudget.countDropped();
+            frameBudget.warnIfTooSmall(width, height);
+            return;
+        }
+        
         // Create a copy of the data to ensure it remains valid even after the caller frees their copy
-        size_t dataSize = width * height * channels;
         unsigned char* dataCopy = new unsigned char[dataSize];
-        std::memcpy(dataCopy, data, dataSize);
+        if (channels == 4) {
+            // The bella engine always delivers RGBA, so this is a plain copy
+            if (factor == 1) std::memcpy(dataCopy, data, dataSize);
+            else downscaleImage(data, width, height, 4, factor, dataCopy);
+        } else {
+            // Other layouts only come from simulateDataFromPathTracer
+            for (size_t i = 0; i < dataSize / 4; i++) {
+                size_t x = (i % std::max(1, width / factor)) * factor;
+                size_t y = (i / std::max(1, width / factor)) * factor;
+                convertPixelToRgba(data + (y * width + x) * channels, channels, dataCopy + i * 4);
+            }
+        }
+        if (factor > 1) {
+            width = std::max(1, width / factor);
+            height = std::max(1, height / factor);
+            frameBudget.countDownscaled();
+        }
         
         // THREAD SAFETY: Add to queue with lock to prevent race conditions
         {
             std::lock_guard<std::mutex> lock(queueMutex);
-            imageQueue.push(ImageData(dataCopy, width, height, channels));
+            imageQueue.push(ImageData(dataCopy, width, height, 4));
         }
     }
     
+    // Expand one pixel with 1-4 channels to RGBA
+    static void convertPixelToRgba(const unsigned char* src, int channels, unsigned char* dst) {
+        if (channels >= 3) {
+            dst[0] = src[0];  // R
+            dst[1] = src[1];  // G
+            dst[2] = src[2];  // B
+            dst[3] = (channels >= 4) ? src[3] : 255;  // A
+        } else {
+            // Grayscale, with alpha when there are two channels
+            dst[0] = dst[1] = dst[2] = src[0];
+            dst[3] = (channels == 2) ? src[1] : 255;
+        }
+    }
+    
+    // THREAD SAFETY: Discard queued frames, oldest first, until bytes can be reserved
+    // Returns true with the bytes reserved, false if the queue emptied before they fit
+    bool dropQueuedFramesFor(size_t bytes) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        while (!imageQueue.empty()) {
+            ImageData& oldest = imageQueue.front();
+            delete[] oldest.data;
+            frameBudget.release(FrameBudget::Queued, oldest.size());
+            frameBudget.countDropped();
+            imageQueue.pop();
+            
+            if (frameBudget.tryReserve(FrameBudget::Queued, bytes)) return true;
+        }
+        return false;
+    }
+    
     // THREAD SAFETY: Process any queued image data - call this from the main thread
     // This is a key method that bridges between threads:
     // 1. The bella engine thread adds data to the queue via queueImageData()
@@ -232,9 +1362,13 @@ public:
         
         // Process the image data if we got any
         // This happens in the main thread where OpenGL operations are safe
+        // The queued copy becomes the conversion buffer, so its bytes move category
+        // rather than being reserved a second time
         if (hasData) {
-            updateImage(imageData.data, imageData.width, imageData.height, imageData.channels);
+            frameBudget.transfer(FrameBudget::Queued, FrameBudget::Conversion, imageData.size());
+            updateImage(imageData.data, imageData.width, imageData.height);
             delete[] imageData.data; // Clean up the data copy
+            frameBudget.release(FrameBudget::Conversion, imageData.size());
         }
     }
     
@@ -245,67 +1379,101 @@ public:
         while (!imageQueue.empty()) {
             ImageData& imageData = imageQueue.front();
             delete[] imageData.data;
+            frameBudget.release(FrameBudget::Queued, imageData.size());
             imageQueue.pop();
         }
     }
     
     // Update the displayed image with new data from the path tracer
+    // rgba is a queued RGBA frame owned by the caller; it is downscaled, blended and
+    // uploaded in place so no second copy of the frame is needed
     // IMPORTANT: This method must ONLY be called from the main thread
     // because it creates OpenGL textures which are context-dependent
-    void updateImage(const unsigned char* data, int width, int height, int channels) {
+    void updateImage(unsigned char* rgba, int width, int height) {
         
         try {
             // Check if data is valid
-            if (!data) {
+            if (!rgba) {
                 std::cerr << "ERROR: Data pointer is NULL" << std::endl;
                 return;
             }
             
-            // Unload existing texture if any
-            if (texture.id != 0) {
-                rl::UnloadTexture(texture);
-                texture = {0};
+            // Reserve however much bigger the new texture is than the old one while the
+            // old texture is still shown, so a frame that doesn't fit is dropped without
+            // blanking the window. The downscale policy instead keeps every step'th pixel until it fits.
+            size_t reservedTexture = textureBytes;
+            auto reserveTexture = [this, &reservedTexture](size_t bytes) {
+                if (bytes <= reservedTexture) return true;
+                if (!frameBudget.tryReserve(FrameBudget::Texture, bytes - reservedTexture)) return false;
+                reservedTexture = bytes;
+                return true;
+            };
+            
+            int step = 1;
+            int outWidth = width;
+            int outHeight = height;
+            size_t outBytes = size_t(outWidth) * outHeight * 4;
+            bool reserved = reserveTexture(outBytes);
+            while (!reserved && frameBudget.policy() == BudgetPolicy::Downscale && (outWidth > 1 || outHeight > 1)) {
+                step *= 2;
+                outWidth = std::max(1, width / step);
+                outHeight = std::max(1, height / step);
+                outBytes = size_t(outWidth) * outHeight * 4;
+                reserved = reserveTexture(outBytes);
+            }
+            if (!reserved) {
+                frameBudget.countDropped();
+                frameBudget.warnIfTooSmall(width, height);
+                return;
+            }
+            if (step > 1) {
+                downscaleImage(rgba, width, height, 4, step, rgba);
+                frameBudget.countDownscaled();
             }
             
-            // Create a copy of the data
-            unsigned char* dataCopy = new unsigned char[width * height * 4]; // Always use 4 channels (RGBA)
+            // Blend the restarted render in over the last converged image. While blending, a smaller
+            // frame is blended onto the reference at its full size, so budget that texture too
+            int displayWidth, displayHeight;
+            blender.displaySize(outWidth, outHeight, displayWidth, displayHeight);
+            if (!reserveTexture(size_t(displayWidth) * displayHeight * 4)) {
+                // No room for the full size texture, show the frame as it is
+                blender.snap();
+            }
+            const unsigned char* pixels = blender.process(rgba, outWidth, outHeight);
+            outBytes = size_t(outWidth) * outHeight * 4;
             
-            // Convert the data to RGBA format
-            for (int i = 0; i < width * height; i++) {
-                int srcIdx = i * channels;
-                int destIdx = i * 4;
-                
-                if (channels >= 3) {
-                    dataCopy[destIdx] = data[srcIdx];     // R
-                    dataCopy[destIdx + 1] = data[srcIdx + 1]; // G
-                    dataCopy[destIdx + 2] = data[srcIdx + 2]; // B
-                    dataCopy[destIdx + 3] = (channels >= 4) ? data[srcIdx + 3] : 255; // A
-                } else if (channels == 1) {
-                    // Grayscale
-                    dataCopy[destIdx] = dataCopy[destIdx + 1] = dataCopy[destIdx + 2] = data[srcIdx];
-                    dataCopy[destIdx + 3] = 255;
-                }
+            // The Texture category now covers the new texture, hand back any surplus
+            if (reservedTexture > outBytes) {
+                frameBudget.release(FrameBudget::Texture, reservedTexture - outBytes);
             }
+            textureBytes = outBytes;
             
             // Create a simple image using the raw data
             
             // Create a new image with the data
             rl::Image image = {0};
-            image.data = dataCopy;
-            image.width = width;
-            image.height = height;
+            image.data = const_cast<unsigned char*>(pixels);
+            image.width = outWidth;
+            image.height = outHeight;
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
             
+            // Unload existing texture if any, only now that the new one is ready to upload
+            if (texture.id != 0) {
+                rl::UnloadTexture(texture);
+                texture = {0};
+            }
+            
             // THREAD SAFETY: Load texture from the image
             // This is now safe because we're in the main thread with valid OpenGL context
             // This was the source of our segfault when called from a different thread
+            // The caller frees the frame (texture keeps a copy), it was allocated
+            // with new[] so it must not go through UnloadImage's free()
             texture = rl::LoadTextureFromImage(image);
             
-            // Unload the image data (texture keeps a copy)
-            rl::UnloadImage(image);
-            
             if (texture.id == 0) {
+                frameBudget.release(FrameBudget::Texture, textureBytes);
+                textureBytes = 0;
                 std::cerr << "ERROR: Failed to create texture" << std::endl;
                 return;
             }
@@ -337,6 +1505,9 @@ public:
             // This is where we safely handle the image data that was queued by other threads
             processImageQueue();
             
+            // Apply scripted scene edits that arrived since the last tick
+            applySceneEdits();
+            
             // Check if window has been resized
             if (rl::IsWindowResized()) {
                 // Update screen dimensions
@@ -362,6 +1533,7 @@ public:
                         dl::Vec2 dollyDelta;
                         dollyDelta.y = wheelMove * 0.8;
                         dl::bella_sdk::zoomCamera( engine->scene().cameraPath(), dollyDelta, true );
+                        blender.snap();
                     }
                 }
                 
@@ -407,10 +1579,135 @@ public:
                 rl::DrawText("Waiting for Bella to render...", screenWidth/2 - 150, screenHeight/2 - 10, 20, DARKGRAY);
             }
             
+            if (frameBudget.limited()) {
+                drawMemoryGauges();
+            }
+            
             rl::EndDrawing();
         }
     }
     
+    // Draw live frame memory usage along the bottom of the window
+    void drawMemoryGauges() {
+        const double mb = 1048576.0;
+        int queued = 0;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            queued = (int)imageQueue.size();
+        }
+        rl::DrawText(rl::TextFormat("mem %.1f/%.1f MB  queue %.1f (%d)  conv %.1f  tex %.1f  accum %.1f",
+                                    frameBudget.used() / mb, frameBudget.limit() / mb,
+                                    frameBudget.used(FrameBudget::Queued) / mb, queued,
+                                    frameBudget.used(FrameBudget::Conversion) / mb,
+                                    frameBudget.used(FrameBudget::Texture) / mb,
+                                    frameBudget.used(FrameBudget::Accumulation) / mb),
+                     10, screenHeight - 40, 10, DARKGRAY);
+        rl::DrawText(rl::TextFormat("peak %.1f MB  dropped %d  downscaled %d",
+                                    frameBudget.peak() / mb, frameBudget.dropped(), frameBudget.downscaled()),
+                     10, screenHeight - 25, 10, DARKGRAY);
+    }
+    
+    // Apply every pending command channel edit in a single EventScope
+    // so a burst of edits only restarts the render once
+    void applySceneEdits() {
+        if (!engine || !commandChannel) return;
+        
+        commandChannel->drain(editBatch);
+        if (editBatch.empty()) return;
+        
+        auto applyStart = std::chrono::steady_clock::now();
+        int applied = 0;
+        bool movesView = false;
+        {
+            dl::bella_sdk::Scene::EventScope eventScope(engine->scene());
+            for (const auto& cmd : editBatch) {
+                if (applySceneEdit(cmd, movesView)) applied++;
+            }
+        }
+        auto applyEnd = std::chrono::steady_clock::now();
+        
+        // Camera and transform edits invalidate the image on screen, anything else
+        // is refined from it. Queued frames predate the edit, so they are discarded.
+        if (applied > 0) {
+            if (movesView) {
+                blender.snap();
+            } else {
+                clearImageQueue();
+                blender.beginRefinement();
+            }
+        }
+        
+        // Apply time covers the EventScope flush, queue time is from the oldest edit's arrival
+        double applyMs = std::chrono::duration<double, std::milli>(applyEnd - applyStart).count();
+        double queueMs = std::chrono::duration<double, std::milli>(applyStart - editBatch.front().received).count();
+        dl::logInfo("Applied %d/%d scene edits in %.2fms (queued %.2fms)",
+                    applied, (int)editBatch.size(), applyMs, queueMs);
+    }
+    
+    // Node types whose edits change what the camera sees: cameras and transforms move
+    // the view, lenses (thinLens, pinholeLens, ...) and sensors change focal length, FOV
+    // or film size. The image on screen can't be reprojected across any of these.
+    static bool changesFraming(const std::string& type) {
+        if (type == "camera" || type == "xform" || type == "sensor") return true;
+        const std::string lens = "Lens";
+        return type.size() >= lens.size() &&
+               type.compare(type.size() - lens.size(), lens.size(), lens) == 0;
+    }
+    
+    // Apply one edit, must be called inside an EventScope
+    // Sets movesView when the edited node changes the framing, see changesFraming()
+    bool applySceneEdit(const SceneEditCommand& cmd, bool& movesView) {
+        try {
+            dl::bella_sdk::Node node = engine->scene().findNode(cmd.node.c_str());
+            if (!node) {
+                dl::logError("Command channel: no node named %s", cmd.node.c_str());
+                return false;
+            }
+            if (changesFraming(node.type().buf())) {
+                movesView = true;
+            }
+            
+            auto input = node[cmd.attr.c_str()];
+            switch (cmd.kind) {
+                case SceneEditCommand::Kind::Real:
+                    input = dl::Real(cmd.values[0]);
+                    break;
+                case SceneEditCommand::Kind::Int:
+                    input = dl::Int(int32_t(cmd.values[0]));  // Range checked when parsed
+                    break;
+                case SceneEditCommand::Kind::Bool:
+                    input = cmd.values[0] != 0.0;
+                    break;
+                case SceneEditCommand::Kind::String:
+                    input = dl::String(cmd.text.c_str());
+                    break;
+                case SceneEditCommand::Kind::Rgba: {
+                    dl::Rgba color;
+                    color.r = cmd.values[0];
+                    color.g = cmd.values[1];
+                    color.b = cmd.values[2];
+                    color.a = cmd.values[3];
+                    input = color;
+                    break;
+                }
+                case SceneEditCommand::Kind::Vec3: {
+                    dl::Vec3 vec;
+                    vec.x = cmd.values[0];
+                    vec.y = cmd.values[1];
+                    vec.z = cmd.values[2];
+                    input = vec;
+                    break;
+                }
+            }
+            return true;
+        } catch (const std::exception& e) {
+            dl::logError("Command channel: failed to set %s.%s: %s", cmd.node.c_str(), cmd.attr.c_str(), e.what());
+        } catch (...) {
+            dl::logError("Command channel: failed to set %s.%s", cmd.node.c_str(), cmd.attr.c_str());
+        }
+        return false;
+    }
+    
     // Handle mouse interaction for camera orbiting
     void handleMouseInteraction() {
         // Only process mouse interaction if we have a valid engine reference
@@ -467,6 +1764,7 @@ public:
                     dl::bella_sdk::Scene::EventScope eventScope(engine->scene());
                     // Use the bsdk namespace to avoid ambiguity with Path
                     dl::bella_sdk::orbitCamera(engine->scene().cameraPath(), delta);
+                    blender.snap();
                 }
                 
                 // Update previous position for next frame
@@ -496,6 +1794,7 @@ public:
                     // It improves performance and ensures consistency of multiple scene changes.
                     dl::bella_sdk::Scene::EventScope eventScope(engine->scene());
                     dl::bella_sdk::panCamera(engine->scene().cameraPath(), delta, true);
+                    blender.snap();
                 }
                 
                 // Update previous position for next frame
@@ -563,40 +1862,32 @@ public:
         }
         
         try {
-            // Create a buffer for our RGBA data
-            unsigned char* buffer = new unsigned char[width * height * 4];
-            
             // Get the raw RGBA data pointer - rgba8() returns Rgba8* (RgbaT<unsigned char>*)
             // No mutex needed as the developers confirmed the data survives within this callback
             dl::Rgba8* rgba_data = image.rgba8();
             
             if (!rgba_data) {
                 std::cerr << "ERROR: rgba8() returned NULL" << std::endl;
-                delete[] buffer;
                 return;
             }
             
-            // Direct memory copy for optimal performance
-            std::memcpy(buffer, rgba_data, width * height * 4);
-            
             // THREAD SAFETY: Use the callback to queue data for processing by the main thread
+            // The engine's pixels are passed straight through: they stay valid until this
+            // callback returns, and queueImageData makes the one copy that outlives it
             try {
                 if (preview->getCallback()) {
                     // Get the callback function from the preview object and invoke it
                     // This passes the image data to the main thread via the callback
                     // When called, this executes the lambda we defined in the constructor
-                    preview->getCallback()(buffer, width, height, 4);
+                    preview->getCallback()(reinterpret_cast<const unsigned char*>(rgba_data), width, height, 4);
                     //std::cout << "Image data queued successfully" << std::endl;
                 } else {
                     std::cerr << "ERROR: Preview callback is NULL" << std::endl;
-                    delete[] buffer;
                 }
             } catch (const std::exception& e) {
                 std::cerr << "Exception in queueing image data: " << e.what() << std::endl;
-                delete[] buffer;  // Clean up if queueing throws
             } catch (...) {
                 std::cerr << "Unknown exception in queueing image data" << std::endl;
-                delete[] buffer;  // Clean up if queueing throws
             }
         } catch (const std::exception& e) {
             std::cerr << "Exception in onImage: " << e.what() << std::endl;
@@ -614,6 +1905,307 @@ public:
     }
 };
 
+// Deterministic camera path for headless turntable rendering
+// Every frame orbits the camera by a fixed step, and the dolly position is
+// linearly interpolated between keyframes. Both are applied as deltas to the
+// scene's camera path using the same SDK calls as the interactive mouse controls.
+struct CameraPathSpec {
+    int frames = 0;
+    float orbitX = 10.0f;  // Orbit delta per frame, same units as mouse orbiting
+    float orbitY = 0.0f;
+    std::vector<std::pair<int, double>> dollyKeys;  // (frame, absolute dolly amount), sorted by frame
+    
+    // Parse "dx,dy"
+    bool parseOrbit(const char* text) {
+        return std::sscanf(text, "%f,%f", &orbitX, &orbitY) == 2;
+    }
+    
+    // Parse "frame:amount,frame:amount,..."
+    bool parseDolly(const char* text) {
+        dollyKeys.clear();
+        const char* cursor = text;
+        while (*cursor) {
+            int frame = 0;
+            double amount = 0.0;
+            int consumed = 0;
+            if (std::sscanf(cursor, "%d:%lf%n", &frame, &amount, &consumed) != 2) {
+                return false;
+            }
+            dollyKeys.emplace_back(frame, amount);
+            cursor += consumed;
+            if (*cursor == ',') cursor++;
+        }
+        std::sort(dollyKeys.begin(), dollyKeys.end());
+        return true;
+    }
+    
+    // Absolute dolly amount at a frame, held constant outside the keyframe range
+    double dollyAt(int frame) const {
+        if (dollyKeys.empty()) return 0.0;
+        if (frame <= dollyKeys.front().first) return dollyKeys.front().second;
+        if (frame >= dollyKeys.back().first) return dollyKeys.back().second;
+        for (size_t i = 1; i < dollyKeys.size(); i++) {
+            if (frame <= dollyKeys[i].first) {
+                const auto& a = dollyKeys[i - 1];
+                const auto& b = dollyKeys[i];
+                double t = double(frame - a.first) / double(b.first - a.first);
+                return a.second + (b.second - a.second) * t;
+            }
+        }
+        return dollyKeys.back().second;
+    }
+};
+
+// Engine observer for headless rendering
+// Keeps a copy of the most recent image so the batch loop can pick it up once the render stops
+struct TurntableObserver : public dl::bella_sdk::EngineObserver {
+    // THREAD SAFETY: frameMutex protects the latest frame, written by the bella engine thread
+    std::mutex frameMutex;
+    std::vector<unsigned char> pixels;
+    int width = 0;
+    int height = 0;
+    
+    void onStarted(dl::String pass) override {
+        dl::logInfo("Started pass %s", pass.buf());
+    }
+    
+    void onImage(dl::String pass, dl::bella_sdk::Image image) override {
+        int w = (int)image.width();
+        int h = (int)image.height();
+        dl::Rgba8* rgba_data = image.rgba8();
+        if (!rgba_data || w <= 0 || h <= 0) {
+            std::cerr << "ERROR: Invalid image from bella" << std::endl;
+            return;
+        }
+        
+        // The image data is only valid within this callback, so copy it out
+        std::lock_guard<std::mutex> lock(frameMutex);
+        pixels.resize(size_t(w) * h * 4);
+        std::memcpy(pixels.data(), rgba_data, pixels.size());
+        width = w;
+        height = h;
+    }
+    
+    void onError(dl::String pass, dl::String msg) override {
+        dl::logError("%s [%s]", msg.buf(), pass.buf());
+    }
+    
+    void onStopped(dl::String pass) override {
+        dl::logInfo("Stopped %s", pass.buf());
+    }
+    
+    // Move the latest frame out, leaving the observer empty for the next render
+    bool takeFrame(std::vector<unsigned char>& out, int& w, int& h) {
+        std::lock_guard<std::mutex> lock(frameMutex);
+        if (pixels.empty()) return false;
+        out.swap(pixels);
+        pixels.clear();
+        w = width;
+        h = height;
+        return true;
+    }
+};
+
+// Headless turntable / camera path renderer
+// Renders each step of a CameraPathSpec to convergence (or a time limit) and writes PNG frames.
+// Encoding runs on a WorkerPool so the camera edit and render for frame N+1 overlap
+// with the encode of frame N.
+class TurntableRenderer {
+private:
+    dl::bella_sdk::Engine& engine;
+    CameraPathSpec spec;
+    std::string outDir;
+    double frameTimeLimit;  // Seconds, 0 = render until the engine stops on its own
+    WorkerPool encoders;
+    TurntableObserver observer;
+    
+    // THREAD SAFETY: statsMutex protects the encode statistics written by encoder jobs
+    std::mutex statsMutex;
+    double totalEncodeSeconds = 0.0;
+    int framesWritten = 0;
+    
+    using Clock = std::chrono::steady_clock;
+    
+    static double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    
+    // Apply the camera delta that moves frame-1 to frame
+    // Frame 0 only moves the scene's camera to the dolly amount of the first key
+    void applyCameraStep(int frame) {
+        dl::bella_sdk::Scene::EventScope eventScope(engine.scene());
+        
+        dl::Vec2 delta;
+        delta.x = spec.orbitX;
+        delta.y = spec.orbitY;
+        if (frame > 0 && (delta.x != 0.0 || delta.y != 0.0)) {
+            dl::bella_sdk::orbitCamera(engine.scene().cameraPath(), delta);
+        }
+        
+        double dolly = frame > 0 ? spec.dollyAt(frame) - spec.dollyAt(frame - 1) : spec.dollyAt(0);
+        if (dolly != 0.0) {
+            dl::Vec2 dollyDelta;
+            dollyDelta.y = dolly;
+            dl::bella_sdk::zoomCamera(engine.scene().cameraPath(), dollyDelta, true);
+        }
+    }
+    
+    // Render the current camera until the engine stops or the time limit is hit
+    bool renderFrame() {
+        if (!engine.start()) {
+            dl::logError("Engine failed to start.");
+            return false;
+        }
+        auto start = Clock::now();
+        while (engine.rendering()) {
+            if (frameTimeLimit > 0.0 && secondsSince(start) >= frameTimeLimit) {
+                engine.stop();
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return true;
+    }
+    
+    void queueEncode(int frame, std::vector<unsigned char> pixels, int width, int height, double renderSeconds) {
+        char name[64];
+        std::snprintf(name, sizeof(name), "frame_%04d.png", frame);
+        std::string path = (std::filesystem::path(outDir) / name).string();
+        
+        // The job owns the pixels, so the observer is free to receive the next render
+        auto data = std::make_shared<std::vector<unsigned char>>(std::move(pixels));
+        encoders.submit([this, frame, data, width, height, path, renderSeconds] {
+            auto start = Clock::now();
+            
+            rl::Image image = {0};
+            image.data = data->data();
+            image.width = width;
+            image.height = height;
+            image.mipmaps = 1;
+            image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            bool ok = rl::ExportImage(image, path.c_str());
+            
+            double encodeSeconds = secondsSince(start);
+            if (!ok) {
+                dl::logError("Failed to write %s", path.c_str());
+                return;
+            }
+            
+            std::lock_guard<std::mutex> lock(statsMutex);
+            totalEncodeSeconds += encodeSeconds;
+            framesWritten++;
+            dl::logInfo("Frame %d: render %.2fs encode %.3fs -> %s",
+                        frame, renderSeconds, encodeSeconds, path.c_str());
+        });
+    }
+
+public:
+    TurntableRenderer(dl::bella_sdk::Engine& engineRef, const CameraPathSpec& pathSpec,
+                      const std::string& outputDir, double timeLimit, int encoderCount)
+        : engine(engineRef), spec(pathSpec), outDir(outputDir),
+          frameTimeLimit(timeLimit), encoders(encoderCount) {
+        engine.subscribe(&observer);
+    }
+    
+    ~TurntableRenderer() {
+        encoders.wait();
+        engine.unsubscribe(&observer);
+    }
+    
+    int run() {
+        std::error_code ec;
+        std::filesystem::create_directories(outDir, ec);
+        if (ec) {
+            dl::logError("Cannot create output directory %s", outDir.c_str());
+            return 1;
+        }
+        
+        auto batchStart = Clock::now();
+        double totalRenderSeconds = 0.0;
+        int framesRendered = 0;
+        
+        for (int frame = 0; frame < spec.frames; frame++) {
+            // The previous frame may still be encoding on the worker pool
+            applyCameraStep(frame);
+            
+            auto renderStart = Clock::now();
+            if (!renderFrame()) break;
+            double renderSeconds = secondsSince(renderStart);
+            
+            std::vector<unsigned char> pixels;
+            int width = 0, height = 0;
+            if (!observer.takeFrame(pixels, width, height)) {
+                dl::logError("Frame %d: no image received from bella", frame);
+                continue;
+            }
+            totalRenderSeconds += renderSeconds;
+            framesRendered++;
+            queueEncode(frame, std::move(pixels), width, height, renderSeconds);
+        }
+        
+        encoders.wait();
+        double batchSeconds = secondsSince(batchStart);
+        
+        std::lock_guard<std::mutex> lock(statsMutex);
+        if (framesWritten > 0) {
+            dl::logInfo("Turntable: %d frames in %.1fs, %.1f frames/hour, avg render %.2fs, avg encode %.3fs",
+                        framesWritten, batchSeconds, framesWritten * 3600.0 / batchSeconds,
+                        totalRenderSeconds / framesRendered, totalEncodeSeconds / framesWritten);
+        }
+        return framesWritten == spec.frames ? 0 : 1;
+    }
+};
+
+// Headless turntable entry point, no window is created
+int runTurntable(dl::Args& args, const dl::String& belPath)
+{
+    CameraPathSpec spec;
+    spec.frames = std::atoi(args.value("--frames").buf());
+    if (spec.frames <= 0) {
+        dl::logError("--frames must be a positive number");
+        return 1;
+    }
+    if (args.have("--orbit") && !spec.parseOrbit(args.value("--orbit").buf())) {
+        dl::logError("Invalid --orbit %s, expected dx,dy", args.value("--orbit").buf());
+        return 1;
+    }
+    if (args.have("--dolly") && !spec.parseDolly(args.value("--dolly").buf())) {
+        dl::logError("Invalid --dolly %s, expected frame:amount,...", args.value("--dolly").buf());
+        return 1;
+    }
+    
+    std::string outDir = args.have("--outdir") ? args.value("--outdir").buf() : "turntable";
+    double timeLimit = args.have("--timelimit") ? std::atof(args.value("--timelimit").buf()) : 0.0;
+    int encoderCount = args.have("--encoders") ? std::atoi(args.value("--encoders").buf())
+                                               : (int)std::max(1u, std::thread::hardware_concurrency() / 4);
+    
+    try {
+        oom::misc::saveHDRI();
+        
+        dl::bella_sdk::Engine engine;
+        engine.scene().loadDefs();
+        engine.enableDisplayTransform();
+        
+        if (!engine.scene().read(belPath)) {
+            dl::logError("Failed to read %s from %s", belPath.buf(), dl::fs::currentDir().buf());
+            return 1;
+        }
+        
+        if (args.have("--targetnoise")) {
+            engine.scene().beautyPass()["targetNoise"] = dl::Int(std::atoi(args.value("--targetnoise").buf()));
+        }
+        
+        TurntableRenderer renderer(engine, spec, outDir, timeLimit, encoderCount);
+        return renderer.run();
+    } catch (const std::exception& e) {
+        std::cerr << "FATAL ERROR: Exception in turntable: " << e.what() << std::endl;
+        return 1;
+    } catch (...) {
+        std::cerr << "FATAL ERROR: Unknown exception in turntable" << std::endl;
+        return 1;
+    }
+}
+
 int DL_main(dl::Args& args)
 {
     int s_oomBellaLogContext = 0;
@@ -624,6 +2216,16 @@ int DL_main(dl::Args& args)
     args.add("tp",  "thirdparty",   "",   "prints third party licenses");
     args.add("li",  "licenseinfo",   "",   "prints license info");
     args.add("i",  "input",   "",   "prints license info");
+    args.add("tf", "frames",   "",   "headless turntable, number of frames to render");
+    args.add("to", "orbit",   "",   "turntable orbit step per frame as dx,dy (default 10,0)");
+    args.add("td", "dolly",   "",   "turntable dolly keyframes as frame:amount,...");
+    args.add("tn", "targetnoise",   "",   "turntable beauty pass target noise");
+    args.add("tl", "timelimit",   "",   "turntable max render seconds per frame");
+    args.add("od", "outdir",   "",   "turntable output directory (default turntable)");
+    args.add("ew", "encoders",   "",   "turntable encode worker threads");
+    args.add("mb", "membudget",   "",   "frame memory budget in MB");
+    args.add("mp", "mempolicy",   "",   "over budget policy: dropoldest, skip or downscale");
+    args.add("cc", "commands",   "",   "scene edit command channel: stdin, fifo:<path> or unix:<path>");
 
     if (args.helpRequested()) {
         std::cout << args.help("poomer-efsw © 2025 Harvey Fong","", "1.0") << std::endl;
@@ -650,6 +2252,10 @@ int DL_main(dl::Args& args)
         }
     }
 
+    if (args.have("--frames")) {
+        return runTurntable(args, belPath);
+    }
+
     try {
         SetTraceLogLevel(LOG_ERROR); 
         // Set raylib configuration flags before creating the window
@@ -661,6 +2267,16 @@ int DL_main(dl::Args& args)
             return 1;
         }
         
+        if (args.have("--membudget")) {
+            BudgetPolicy policy = BudgetPolicy::DropOldest;
+            if (args.have("--mempolicy") && !FrameBudget::parsePolicy(args.value("--mempolicy").buf(), policy)) {
+                dl::logError("Unknown --mempolicy %s, use dropoldest, skip or downscale", args.value("--mempolicy").buf());
+                return 1;
+            }
+            double megabytes = std::atof(args.value("--membudget").buf());
+            preview.setMemoryBudget(size_t(megabytes * 1048576.0), policy);
+        }
+        
         // Add a small delay to ensure the OpenGL context is fully set up
         //std::cout << "Waiting for OpenGL context to initialize..." << std::endl;
         for (int i = 0; i < 5; i++) {
@@ -685,6 +2301,14 @@ int DL_main(dl::Args& args)
         // Create our custom observer and connect it to the preview window
         BellaEngineObserver engineObserver(&preview);
         engine.subscribe(&engineObserver);
+        
+        // Optional channel for scripted scene edits
+        std::unique_ptr<SceneCommandChannel> commandChannel;
+        if (args.have("--commands")) {
+            commandChannel.reset(new SceneCommandChannel(args.value("--commands").buf()));
+            if (!commandChannel->start()) return 1;
+            preview.setCommandChannel(commandChannel.get());
+        }
 
         // Get the preview scene with material sphere
         if (belPath != "") {